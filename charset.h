@@ -4,8 +4,8 @@
 /*	by Ralf Brown / Carnegie Mellon University			*/
 /*									*/
 /*  File:     charset.h							*/
-/*  Version:  1.22							*/
-/*  LastEdit: 01jul2013							*/
+/*  Version:  1.25							*/
+/*  LastEdit: 18oct2026							*/
 /*                                                                      */
 /*  (c) Copyright 2010,2011,2012,2013					*/
 /*		 Ralf Brown/Carnegie Mellon University			*/
@@ -30,6 +30,7 @@
 #include <stdint.h>
 #include <wchar.h>
 #include "language.h"
+#include "score.h"
 #include "langident/trie.h"
 
 #ifdef NO_ICONV
@@ -40,11 +41,28 @@ typedef void *iconv_t ;
 
 using namespace std ;
 
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// flags in the per-byte classification table of single-byte character sets
+#define BC_VALID	0x01	// byte is a complete, nonzero character
+#define BC_ALNUM	0x02	// character is alphanumeric
+#define BC_DESIRED	0x04	// character is in the desired language's set
+#define BC_BLANK	0x08	// space or tab
+#define BC_NEWLINE	0x10	// carriage return or line feed
+
+// flags in the per-byte role table of every character set
+#define BR_LEAD		0x01	// byte may be the first byte of a character
+#define BR_PART		0x02	// byte may occur anywhere in a character
+
 /************************************************************************/
 /************************************************************************/
 
 // forward declaration, don't need to know details in this header
+class CharacterSet ;
 class CodePoints ;
+class OutputBuffer ;
 class NybbleTrie ;
 class NybbleTriePointer ;
 
@@ -58,6 +76,27 @@ enum EscapeState
 
 //----------------------------------------------------------------------
 
+// the state of a string being decoded by a character set's scanning kernel
+class ScanState
+   {
+   public:
+      NybbleTriePointer   *m_dictionary ;
+      const unsigned char *m_buf ;
+      int		   m_buflen ;
+      int		   m_length ;
+      EscapeState	   m_escape ;
+      bool		   m_prev_alphanum ;
+      StringScore	   m_score ;
+   } ;
+
+// decode characters until reaching 'limit' or the end of the string,
+//   stopping early if more than 'maxgap' undesired characters occur in
+//   a row; returns true if the string may continue past 'limit'
+typedef bool ScanKernel(const CharacterSet *set, ScanState &state,
+			const unsigned char *limit, unsigned maxgap) ;
+
+//----------------------------------------------------------------------
+
 class CharacterCode
    {
    private:
@@ -93,6 +132,9 @@ class CharacterSet
       iconv_t	    m_iconv ;
       bool	    m_iconv_available ;
       bool	    m_newline_OK ;
+      bool	    m_have_byteclasses ;
+      unsigned char m_byteclasses[256] ;
+      unsigned char m_byteroles[256] ;
 
    public:
       // constructors and destructors
@@ -107,6 +149,7 @@ class CharacterSet
       bool setLanguageChars(const char *language_chars) ;
       bool setLanguageFromFile(const char *language_file) ;
       bool loadWordList(const char *wordlist_file, bool verbose) ;
+      void updateByteTables() ;
 
       // accessors
       virtual size_t encodingSize() const = 0 ;
@@ -118,24 +161,37 @@ class CharacterSet
       virtual bool bigEndian() const { return false ; }
       virtual double detectionReliability() const { return 1.0 ; }
       virtual unsigned alignment() const { return 1 ; }
+      // true if every character is a single byte whose value is also its
+      //   code point, so that it may be classified by table lookup
+      virtual bool singleByteCodes() const { return false ; }
+      // true if nextCodePoint() only accepts characters whose trailing bytes
+      //   are in the successor range of their first byte's CharacterCode
+      virtual bool boundedSuccessors() const { return true ; }
+      // the string-scanning loop specialized for this character set;
+      //   any class which overrides nextCodePoint() or isAlphaNum() must
+      //   also override this function if its parent does
+      virtual ScanKernel *scanKernel() const ;
       virtual bool romanizable(const unsigned char *s, size_t buflen) const ;
       virtual int consumeNewlines(const unsigned char *s, size_t buflen) const ;
       bool newlineOK() const { return m_newline_OK ; }
       bool validSuccessors(const unsigned char *s) const ;
       bool desiredCodePoint(wchar_t codepoint) const
          { return m_desired ? m_desired->validPoint(codepoint) : true ; }
+      const unsigned char *byteClasses() const
+         { return m_have_byteclasses ? m_byteclasses : 0 ; }
+      const unsigned char *byteRoles() const { return m_byteroles ; }
       const char *encodingName() const { return m_encname ; }
       const char *encoding() const { return m_encoding ; }
       NybbleTriePointer *dictionary() const ;
       static const char *normalizedEncodingName(const char *encoding) ;
 
       // output
-      bool writeUTF(FILE *fp, wchar_t codepoint, bool romanize = false,
+      bool writeUTF(OutputBuffer &out, wchar_t codepoint, bool romanize = false,
 		    OutputFormat fmt = OF_UTF8) const ;
       bool convertToUTF8(const char *inbuffer, size_t inlen,
 			 char *outbuffer, size_t outlen, bool romanize = false) ;
       virtual bool initializeIconv() ;
-      virtual bool writeAsUTF(FILE *fp, const unsigned char *buffer,
+      virtual bool writeAsUTF(OutputBuffer &out, const unsigned char *buffer,
 			      size_t buflen, bool romanize = false,
 			      OutputFormat fmt = OF_UTF8) ;
    } ;
@@ -4,8 +4,8 @@
 /*	by Ralf Brown / Carnegie Mellon University			*/
 /*									*/
 /*  File:     extract.h							*/
-/*  Version:  1.23							*/
-/*  LastEdit: 20aug2013							*/
+/*  Version:  1.25							*/
+/*  LastEdit: 18oct2026							*/
 /*                                                                      */
 /*  (c) Copyright 2010,2011,2012,2013					*/
 /*		 Ralf Brown/Carnegie Mellon University			*/
@@ -40,6 +40,13 @@
 #define DEFAULT_DESIRED_PERCENT 0.5
 #define DEFAULT_MIN_SCORE 0.1
 
+// the size of the buffer from which strings are extracted
+#define EXTRACT_BUFFER_LENGTH 8192
+
+// skip blocks of input whose entropy in bits per byte is at least this
+//   high, as they are almost certainly compressed or encrypted
+#define DEFAULT_MAX_ENTROPY 7.5
+
 // how many character sets will we attempt to check if automatic charset
 //   identification is unsuccessful?
 #define ENCID_FALLBACK_SETS 3
@@ -49,6 +56,15 @@
 
 class LanguageIdentifier ;
 
+// how extracted strings are written: as text lines, or as records for
+//   other programs to load
+enum RecordFormat
+   {
+      RF_Text,
+      RF_JSONL,
+      RF_Binary
+   } ;
+
 typedef bool StringOutputFunction(const unsigned char *buf, unsigned len,
 				  uint64_t bufloc, CharacterSet *charset,
 				  double confidence, const class LanguageScores *scores,
@@ -75,10 +91,13 @@ class ExtractParameters
       unsigned  m_maxlangs ;
       unsigned  m_numcharsets ;		// how many character-set mappings do we have?
       unsigned  m_numencsets ;		// how many encoding-identification mappings do we have?
+      unsigned  m_readbuffer ;		// size of prefetched input blocks in MB (0=default)
       double	m_desiredpercent ;
       double	m_alphapercent ;
       double	m_minscore ;
+      double	m_maxentropy ;
       OutputFormat m_output_format ;
+      RecordFormat m_record_format ;
       bool	m_newlines ;
       bool	m_showconf ;
       bool	m_showfile ;
@@ -91,6 +110,9 @@ class ExtractParameters
       bool	m_friendly_name ;
       bool	m_romanize ;
       bool      m_forceCRLF ;
+      bool	m_prefetch ;		// prefetch all inputs, not just pipes/devices?
+      bool	m_directIO ;
+      bool	m_joinsegments ;	// read split images as one input?
    public:
       ExtractParameters()
 	 { m_start = 0 ; m_end = (uint64_t)~0 ; m_maxgap = DEFAULT_MAX_GAP ;
@@ -105,10 +127,14 @@ class ExtractParameters
 	   m_desiredpercent = DEFAULT_DESIRED_PERCENT ;
 	   m_alphapercent = DEFAULT_ALPHA_PERCENT ;
 	   m_locationradix = 0 ; m_minscore = DEFAULT_MIN_SCORE ;
+	   m_maxentropy = DEFAULT_MAX_ENTROPY ;
+	   m_readbuffer = 0 ; m_prefetch = false ; m_directIO = false ;
+	   m_joinsegments = false ;
 	   m_smooth_scores = true ; m_showscript = false ; 
 	   m_newlines = false ; m_showconf = false ; m_showenc = false ;
 	   m_showfile = false ; m_separate_outputs = false ;
 	   m_identify_lang = false ; m_output_format = OF_Native ;
+	   m_record_format = RF_Text ;
 	   m_romanize = false ; m_forceCRLF = false ; }
       ExtractParameters(const ExtractParameters &orig) ;
       ~ExtractParameters() ;
@@ -131,7 +157,13 @@ class ExtractParameters
       double minDesiredPercent() const { return m_desiredpercent ; }
       double minAlphaPercent() const { return m_alphapercent ; }
       double minimumScore() const { return m_minscore ; }
+      double maximumEntropy() const { return m_maxentropy ; }
+      unsigned readBufferSize() const { return m_readbuffer ; }
+      bool prefetchInput() const { return m_prefetch ; }
+      bool directIO() const { return m_directIO ; }
+      bool joinSegments() const { return m_joinsegments ; }
       OutputFormat outputFormat() const { return m_output_format ; }
+      RecordFormat recordFormat() const { return m_record_format ; }
       bool newlinesAllowed() const { return m_newlines; }
       bool showConfidence() const { return m_showconf ; }
       bool showFilename() const { return m_showfile ; }
@@ -183,6 +215,7 @@ class ExtractParameters
 
       void wantFriendlyName(bool fr = true) { m_friendly_name = fr ; }
       void outputFormat(OutputFormat fmt) { m_output_format = fmt ; }
+      void recordFormat(RecordFormat fmt) { m_record_format = fmt ; }
       void romanizeOutput(bool rom) { m_romanize = rom ; }
       void wantLocation(char locspec) ;
       void wantCRLF(bool force) ;
@@ -190,6 +223,10 @@ class ExtractParameters
       void setAlpha(double a) { m_alphapercent = a ; }
       void setMinimumScore(double s)
       	 { m_minscore = (s > 0.0) ? s : DEFAULT_MIN_SCORE ; }
+      void setMaximumEntropy(double e) { m_maxentropy = e ; }
+      void setPrefetch(unsigned megabytes, bool direct = false)
+	 { m_readbuffer = megabytes ; m_prefetch = true ; m_directIO = direct ; }
+      void wantJoinedSegments(bool join = true) { m_joinsegments = join ; }
    } ;
 
 //----------------------------------------------------------------------
@@ -207,6 +244,10 @@ class InputStream
       virtual bool endOfData() const = 0 ;
       virtual uint64_t currentOffset() const = 0 ;
       virtual unsigned get(unsigned count, unsigned char *buffer) = 0 ;
+      // if positioned at a region of the input known to contain nothing
+      //   (such as a hole in a sparse file), move past it and return the
+      //   number of bytes skipped
+      virtual uint64_t skipHole() { return 0 ; }
    } ;
 
 //----------------------------------------------------------------------
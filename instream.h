@@ -0,0 +1,186 @@
+/****************************** -*- C++ -*- *****************************/
+/*                                                                      */
+/*	LA-Strings: language-aware text-strings extraction		*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File:     instream.h						*/
+/*  Version:  1.25							*/
+/*  LastEdit: 18oct2026							*/
+/*                                                                      */
+/*  (c) Copyright 2026 Ralf Brown/Carnegie Mellon University		*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __INSTREAM_H_INCLUDED
+#define __INSTREAM_H_INCLUDED
+
+#include <cstdio>
+#include "extract.h"
+
+#if defined(FrMULTITHREAD)
+#  include <pthread.h>
+#endif /* FrMULTITHREAD */
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// the size (in megabytes) of each of the blocks read by the prefetching
+//   input stream
+#define PREFETCH_DEFAULT_MB 4
+#define PREFETCH_MAX_MB 16
+
+// how many blocks may be read ahead of the one being scanned
+#define PREFETCH_BUFFERS 4
+
+// the alignment of buffers, file offsets, and read sizes required for
+//   direct I/O
+#define PREFETCH_ALIGN 4096
+
+/************************************************************************/
+/************************************************************************/
+
+// read a file or pipe through stdio, skipping the holes in sparse files
+class InputStreamFile : public InputStream
+   {
+   private:
+      FILE *m_fp ;
+      uint64_t m_data_end ;		// end of current allocated extent
+      bool  m_sparse ;			// does the file have any holes?
+   public:
+      InputStreamFile(FILE *fp) ;
+      virtual ~InputStreamFile()
+	 { if (m_fp && m_fp != stdin) { fclose(m_fp) ; } }
+
+      virtual bool endOfData() const { return m_fp ? feof(m_fp) : true ; }
+      virtual uint64_t currentOffset() const
+	 { return (!m_fp || m_fp == stdin) ? 0 : (uint64_t)ftell(m_fp) ; }
+      virtual unsigned get(unsigned count, unsigned char *buffer) ;
+      virtual uint64_t skipHole() ;
+   } ;
+
+//----------------------------------------------------------------------
+
+// read a file, device, or pipe in large blocks; when built with thread
+//   support, a separate reader thread keeps a ring of blocks filled so that
+//   the scanner never waits on read() unless it has caught up with the
+//   input.  Optionally uses direct I/O (O_DIRECT) to bypass the OS's
+//   buffer cache when reading regular files or block devices.
+class InputStreamPrefetch : public InputStream
+   {
+   private:
+      FILE	    *m_fp ;
+      char	    *m_blocks[PREFETCH_BUFFERS] ;
+      unsigned char *m_ring[PREFETCH_BUFFERS] ;	// aligned within m_blocks
+      size_t	     m_filled[PREFETCH_BUFFERS] ;
+      size_t	     m_bufsize ;
+      size_t	     m_pos ;		// read position in head buffer
+      size_t	     m_discard ;	// leading bytes of input to drop
+      uint64_t	     m_offset ;		// offset of next byte from get()
+      uint64_t	     m_remaining ;	// bytes the reader has yet to read
+      unsigned	     m_numbuffers ;
+      unsigned	     m_head ;		// buffer being scanned
+      unsigned	     m_tail ;		// buffer being read
+      unsigned	     m_ready ;		// number of filled buffers
+      int	     m_fd ;
+      bool	     m_fill_blocks ;	// read until block full?
+      bool	     m_direct ;		// using O_DIRECT?
+      bool	     m_holding ;	// is head buffer in use by get()?
+      bool	     m_eof ;		// has get() reached the end of data?
+#if defined(FrMULTITHREAD)
+      pthread_t	     m_thread ;
+      pthread_mutex_t m_lock ;
+      pthread_cond_t m_data_ready ;
+      pthread_cond_t m_space_ready ;
+      bool	     m_threaded ;
+      bool	     m_stop ;
+#endif /* FrMULTITHREAD */
+   protected:
+      size_t readBlock(unsigned char *buffer) ;
+      bool nextBuffer() ;
+      void releaseBuffer() ;
+#if defined(FrMULTITHREAD)
+      static void *readerThread(void *stream) ;
+      void readAhead() ;
+#endif /* FrMULTITHREAD */
+   public:
+      // read from the current position of 'fp' up to 'end_offset', in
+      //   blocks of 'megabytes' MB (0 = default size)
+      InputStreamPrefetch(FILE *fp, uint64_t end_offset, unsigned megabytes,
+			  bool direct_io = false) ;
+      virtual ~InputStreamPrefetch() ;
+
+      // accessors
+      virtual bool endOfData() const
+	 { return m_ring[0] ? m_eof : (m_fp ? feof(m_fp) : true) ; }
+      virtual uint64_t currentOffset() const { return m_offset ; }
+      virtual unsigned get(unsigned count, unsigned char *buffer) ;
+   } ;
+
+//----------------------------------------------------------------------
+
+// read a raw disk image which has been split into a numbered series of
+//   files (image.001, image.002, ...) as one contiguous input, reporting
+//   offsets from the start of the whole image
+class InputStreamSegments : public InputStream
+   {
+   private:
+      const ExtractParameters *m_params ;
+      char	   **m_names ;
+      uint64_t	    *m_starts ;		// offset of each segment in image
+      InputStream   *m_stream ;		// reads the current segment
+      uint64_t	     m_end ;		// offset at which to stop reading
+      unsigned	     m_count ;
+      unsigned	     m_current ;
+   protected:
+      bool openSegment(unsigned N, uint64_t offset) ;
+   public:
+      // collect the first segment and all those following it
+      InputStreamSegments(const char *first_segment,
+			  const ExtractParameters *params) ;
+      virtual ~InputStreamSegments() ;
+
+      // does the name look like that of the first segment of a split image?
+      static bool firstSegment(const char *filename) ;
+
+      // position the stream at 'offset' in the image, to read up to
+      //   'end_offset'
+      bool seek(uint64_t offset, uint64_t end_offset) ;
+
+      // accessors
+      unsigned numSegments() const { return m_count ; }
+      const char *segmentName(unsigned N) const
+	 { return N < m_count ? m_names[N] : 0 ; }
+      uint64_t size() const { return m_starts[m_count] ; }
+      virtual bool endOfData() const
+	 { return m_stream ? (m_current + 1 >= m_count && m_stream->endOfData())
+	                   : true ; }
+      virtual uint64_t currentOffset() const
+	 { return m_stream ? m_starts[m_current] + m_stream->currentOffset()
+	                   : size() ; }
+      virtual unsigned get(unsigned count, unsigned char *buffer) ;
+      virtual uint64_t skipHole()
+	 { return m_stream ? m_stream->skipHole() : 0 ; }
+   } ;
+
+//----------------------------------------------------------------------
+
+// create the most suitable stream for reading 'fp' up to 'end_offset'
+InputStream *open_input_stream(FILE *fp, uint64_t end_offset,
+			       const ExtractParameters *params) ;
+
+#endif /* !__INSTREAM_H_INCLUDED */
+
+/* end of file instream.h */
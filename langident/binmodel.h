@@ -0,0 +1,88 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*	LangIdent: n-gram based language-identification			*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File: binmodel.h - binary form of n-gram frequency lists		*/
+/*  Version:  1.25				       			*/
+/*  LastEdit: 18oct2026							*/
+/*									*/
+/*  (c) Copyright 2026 Ralf Brown/CMU					*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __BINMODEL_H_INCLUDED
+#define __BINMODEL_H_INCLUDED
+
+#include <stdint.h>
+#include "FramepaC.h"
+
+/************************************************************************/
+/************************************************************************/
+
+class LanguageID ;
+class NybbleTrie ;
+
+//----------------------------------------------------------------------
+// a frequency list as loaded by mklangid, stored as sorted arrays of
+//   keys, counts, and stop-gram flags following a header with the
+//   model's description; the file is memory-mapped and used in place,
+//   so it is stored in native byte order and rejected on a mismatch
+
+class BinaryModel
+   {
+   private:
+      FrFileMapping	*m_fmap ;
+      char		*m_buffer ;	// file contents if not mappable
+      const uint32_t	*m_keyoffsets ;	// [numngrams+1] into m_keys
+      const uint32_t	*m_frequencies ;
+      const uint8_t	*m_stopgrams ;
+      const uint8_t	*m_keys ;
+      const char	*m_strings ;
+      const class BinaryModelHeader *m_header ;
+      uint32_t		 m_numngrams ;
+   protected:
+      void init() ;
+      bool validate(const char *base, size_t filesize) ;
+      const char *poolString(uint32_t offset) const ;
+   public:
+      BinaryModel(const char *filename) ;
+      ~BinaryModel() ;
+
+      // accessors
+      bool good() const { return m_header != 0 ; }
+      uint32_t numNgrams() const { return m_numngrams ; }
+      uint64_t totalBytes() const ;
+      unsigned longestKey() const ;
+      bool scaled() const ;
+      bool ignoringWhiteSpace() const ;
+      void getLanguageInfo(LanguageID &opts) const ;
+      const uint8_t *key(uint32_t N) const
+	 { return m_keys + m_keyoffsets[N] ; }
+      unsigned keyLength(uint32_t N) const
+	 { return m_keyoffsets[N+1] - m_keyoffsets[N] ; }
+      uint32_t frequency(uint32_t N) const { return m_frequencies[N] ; }
+      bool isStopgram(uint32_t N) const { return m_stopgrams[N] != 0 ; }
+
+      // I/O
+      static bool isBinaryModel(const char *filename) ;
+      static bool write(const char *filename, const NybbleTrie *ngrams,
+			uint64_t total_bytes, bool scaled,
+			const LanguageID &opts) ;
+   } ;
+
+#endif /* !__BINMODEL_H_INCLUDED */
+
+/* end of file binmodel.h */
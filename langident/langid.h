@@ -4,8 +4,8 @@
 /*	by Ralf Brown / Carnegie Mellon University			*/
 /*									*/
 /*  File:     langid.h							*/
-/*  Version:  1.24							*/
-/*  LastEdit: 14mar2014							*/
+/*  Version:  1.25							*/
+/*  LastEdit: 19oct2026							*/
 /*                                                                      */
 /*  (c) Copyright 2010,2011,2012,2013,2014				*/
 /*		 Ralf Brown/Carnegie Mellon University			*/
@@ -48,6 +48,10 @@ using namespace std ;
 
 #define LANGID_FILE_DMOFFSET  96
 
+// location within the reserved header padding of the offset of the
+//   precomputed identifier metadata (zero if the file doesn't have any)
+#define LANGID_FILE_MDOFFSET  88
+
 // version 1-4 file format uses fixed-length string fields for simplicity
 #define LANGID_STRING_LENGTH 64
 
@@ -119,8 +123,16 @@ class TrigramCounts
    {
    private:
       uint32_t m_counts[256 * 256 * 256] ;
+      // one bit per (c1,c2) row of m_counts which may hold nonzero
+      //   counts, so that scans over the table can skip the empty rows
+      uint64_t m_rows[256 * 256 / 64] ;
+   protected:
+      void markRow(unsigned row) { m_rows[row / 64] |= (1ULL << (row % 64)) ; }
+      void markRows() ;
    public:
-      TrigramCounts() { memset(m_counts,'\0',sizeof(m_counts)) ; }
+      TrigramCounts()
+	 { memset(m_counts,'\0',sizeof(m_counts)) ;
+	   memset(m_rows,'\0',sizeof(m_rows)) ; }
       TrigramCounts(const TrigramCounts *orig) ;
       ~TrigramCounts() {}
 
@@ -128,14 +140,18 @@ class TrigramCounts
       uint32_t count(uint8_t c1, uint8_t c2, uint8_t c3) const
 	 { return m_counts[(c1 << 16) + (c2 << 8) + c3] ; }
       uint32_t totalCount(uint8_t c1, uint8_t c2) const ;
+      bool rowUsed(unsigned row) const
+	 { return (m_rows[row / 64] & (1ULL << (row % 64))) != 0 ; }
       bool enumerate(NybbleTrie &ngrams) const ;
 
       // modifiers
       void copy(const TrigramCounts *orig) ;
+      void merge(const TrigramCounts *other) ;
       void clear(uint8_t c1, uint8_t c2, uint8_t c3)
 	 { m_counts[(c1 << 16) + (c2 << 8) + c3] = 0 ; }
       void incr(uint8_t c1, uint8_t c2, uint8_t c3, uint32_t count = 1)
-	 { m_counts[(c1 << 16) + (c2 << 8) + c3] += count ; }
+	 { m_counts[(c1 << 16) + (c2 << 8) + c3] += count ;
+	   markRow((c1 << 8) + c2) ; }
       void filter(unsigned K, unsigned max_len, bool verbose) ;
       void filter(int32_t threshold) ;
 
@@ -204,6 +220,7 @@ class LanguageID
       double m_matchfactor ;
       unsigned m_alignment ;
       uint64_t m_trainbytes ;
+      bool   m_shared_strings ;		// strings owned by someone else?
    protected:
       void clear() ;
    public:
@@ -230,6 +247,8 @@ class LanguageID
       double freqCoverage() const { return m_freqcover ; }
       double matchFactor() const { return m_matchfactor ; }
       uint64_t trainingBytes() const { return m_trainbytes ; }
+      void storedCoverage(uint32_t &cover, uint32_t &count_cover,
+			  uint32_t &freq_cover, uint32_t &match) const ;
 
       // modifiers
       void setLanguage(const char *lang, const char *friendly = 0) ;
@@ -244,6 +263,14 @@ class LanguageID
       void setFreqCoverage(double coverage) ;
       void setMatchFactor(double match) ;
       void setTraining(uint64_t train_bytes) { m_trainbytes = train_bytes ; }
+      void setStoredCoverage(uint32_t cover, uint32_t count_cover,
+			     uint32_t freq_cover, uint32_t match) ;
+      // point at strings whose storage belongs to someone else, such as
+      //   a memory-mapped database; they will be copied on modification
+      void shareStrings(const char *lang, const char *friendly,
+			const char *reg, const char *enc, const char *source,
+			const char *script) ;
+      void unshareStrings() ;
       // operators
       bool sameLanguage(const LanguageID &other, bool ignore_region) const ;
       bool matches(const LanguageID *lang_info) const ;
@@ -355,12 +382,15 @@ class WeightedLanguageScores : public LanguageScores
 //----------------------------------------------------------------------
 
 class MultiTrie ;
+class PackedTrieBuilder ;
+class ModelSimilarities ;
 
 class LanguageIdentifier
    {
    private:
       PackedMultiTrie *m_langdata ;
       MultiTrie       *m_uncomplangdata ;
+      PackedTrieBuilder *m_triebuilder ; // writes the trie, if set
       LanguageID      *m_langinfo ;
       uint8_t 	      *m_alignments ;
       uint8_t	      *m_unaligned ;
@@ -368,10 +398,20 @@ class LanguageIdentifier
       double	      *m_length_factors ;
       double	      *m_adjustments ;
       char	      *m_directory ;
+      FrFileMapping   *m_metadata ;	 // mapped precomputed tables, if any
+      const uint32_t  *m_name_index ;	 // model numbers sorted by language
+      const char     **m_encoding_names ; // distinct model encodings
+      unsigned short  *m_encoding_ids ;	 // model number -> encoding number
       LanguageIdentifier *m_charsetident ;
+      LanguageIdentifier **m_overlays ;	 // additional databases scored too
+      uint32_t	      *m_overlay_base ;	 // number of overlay's first model
+      bool	      *m_shadowed ;	 // models replaced by an overlay
+      ModelSimilarities *m_similarities ; // cached by computeSimilarities()
+      size_t	       m_num_overlays ;
       double 	       m_bigram_weight ;
       size_t	       m_alloc_languages ;
       size_t 	       m_num_languages ;
+      size_t	       m_num_encodings ;
       bool   	       m_friendly_name ;
       bool	       m_apply_cover_factor ;
       bool             m_verbose ;
@@ -381,6 +421,13 @@ class LanguageIdentifier
    private:
       void setAlignments() ;
       bool setAdjustmentFactors() ;
+      bool setEncodingMap() ;
+      bool addEncoding(size_t langnum) ;
+      void releaseMetadata() ;
+      bool remapLanguages(const uint32_t *langmap) ;
+      bool loadMetadata(FILE *fp, uint64_t md_offset,
+			const char *language_data_file) ;
+      uint64_t writeMetadata(FILE *fp, uint64_t trie_offset) const ;
    public:
       LanguageIdentifier(const char *language_data_file,
 			 bool verbose = false) ;
@@ -395,6 +442,12 @@ class LanguageIdentifier
       double adjustmentFactor(size_t N) const { return m_adjustments[N] ; }
       LanguageIdentifier *charsetIdentifier() const { return m_charsetident ; }
       PackedMultiTrie *trie() const { return m_langdata ; }
+      size_t numOverlays() const { return m_num_overlays ; }
+      const LanguageIdentifier *overlay(size_t N) const
+	 { return N < numOverlays() ? m_overlays[N] : 0 ; }
+      bool shadowed(size_t N) const
+	 { return m_shadowed && N < numLanguages() && m_shadowed[N] ; }
+      PackedTrieBuilder *trieBuilder() const { return m_triebuilder ; }
       PackedMultiTrie *packedTrie() ;
       MultiTrie *unpackedTrie() ;
       const char *databaseLocation() const { return m_directory ; }
@@ -402,9 +455,15 @@ class LanguageIdentifier
       const char *friendlyName(size_t N) const ;
       const char *languageScript(size_t N) const ;
       const uint8_t *alignments() const { return m_alignments ; }
+      const uint8_t *unaligned() const { return m_unaligned ; }
       char *languageDescriptor(size_t N) const ; // use FrFree() on result
       const char *languageEncoding(size_t N) const ;
       const char *languageSource(size_t N) const ;
+      size_t numEncodings() const { return m_num_encodings ; }
+      const char *encodingName(size_t E) const
+	 { return E < numEncodings() ? m_encoding_names[E] : 0 ; }
+      unsigned encodingNumber(size_t N) const
+	 { return N < numLanguages() ? m_encoding_ids[N] : ~0 ; }
       const LanguageID *languageInfo(size_t N) const
 	 { return N < numLanguages() ? &m_langinfo[N] : 0 ; }
       uint64_t trainingBytes(size_t N) const
@@ -429,20 +488,35 @@ class LanguageIdentifier
 				double cutoff_ratio = 0.1) const ;
       static void freeScores(LanguageScores *scores) ;
       LanguageScores *similarity(unsigned langid) const ;
+      // like similarity(), but only the scores of at least min_similarity
+      //   are set; uses the cached similarities if computeSimilarities()
+      //   was called with a threshold no higher than min_similarity
+      LanguageScores *similarity(unsigned langid,
+				 double min_similarity) const ;
+      const ModelSimilarities *similarities() const { return m_similarities ; }
       bool sameLanguage(size_t L1, size_t L2,
 			bool ignore_region = false) const ;
       double bigramWeight() const { return m_bigram_weight ; }
 
       // modifiers
       uint32_t addLanguage(const LanguageID &info, uint64_t train_bytes) ;
+      bool replaceLanguage(size_t N, const LanguageID &info,
+			   uint64_t train_bytes) ;
+      bool removeLanguage(size_t N) ;
+      // score the models of another database along with our own,
+      //   numbering them after the existing models; takes ownership
+      bool addOverlay(LanguageIdentifier *overlay) ;
       void charsetIdentifier(LanguageIdentifier *id) 
 	 { m_charsetident = (id ? id : this) ; }
       void setBigramWeight(double weight) { m_bigram_weight = weight ; }
       void useFriendlyName(bool friendly = true) { m_friendly_name = friendly ; }
+      void useTrieBuilder(PackedTrieBuilder *bld) ; // takes ownership
       void runVerbosely(bool v) { m_verbose = v ; }
       void applyCoverageFactor(bool apply) { m_apply_cover_factor = apply ; }
       void incrStringCount(size_t langnum) ;
-      bool computeSimilarities() ;
+      // find and cache the similarities of all pairs of models which
+      //   are at least min_similarity, using 'threads' threads
+      bool computeSimilarities(double min_similarity, unsigned threads = 1) ;
 
       // I/O
       static bool checkSignature(FILE *fp, unsigned *version = 0) ;
@@ -453,6 +527,55 @@ class LanguageIdentifier
       bool dump(FILE *fp, bool show_ngrams = false) const ;
    } ;
 
+//----------------------------------------------------------------------
+// incrementally score a window which slides forward through a stream, as
+//   used for character-set identification; the n-grams starting in the
+//   bytes which the window has already covered are remembered, so each
+//   call only needs to walk the trie for the newly-added bytes (plus the
+//   last few positions, whose n-grams may be cut off by the window's end)
+//   and to subtract the remembered n-grams of the bytes which have left
+
+class SlidingWindowIdentifier
+   {
+   private:
+      const LanguageIdentifier *m_ident ;
+      double   *m_length_factors ;
+      double   *m_totals ;	// unnormalized scores of committed positions
+      uint64_t *m_match_pos ;	// FIFO of n-grams from committed positions
+      uint32_t *m_match_node ;
+      uint8_t  *m_match_len ;
+      size_t    m_match_head ;
+      size_t    m_match_tail ;
+      size_t    m_match_alloc ;
+      uint64_t  m_start ;	// stream offset of the window's first byte
+      uint64_t  m_pos ;		// stream offset of buffer being scanned
+      uint64_t  m_committed ;	// first position not yet committed
+      unsigned  m_minhist ;
+      unsigned  m_slides ;	// calls since totals were last recomputed
+      bool      m_apply_stop_grams ;
+   private:
+      void addNode(double *totals, uint32_t nodeindex, unsigned len,
+		   double weight) const ;
+      bool addMatch(uint64_t pos, uint32_t nodeindex, unsigned len) ;
+      void scanPosition(const char *buffer, size_t buflen, size_t index,
+			double *totals, bool remember) ;
+      void retire(uint64_t new_start) ;
+      void recomputeTotals() ;
+   public:
+      SlidingWindowIdentifier(const LanguageIdentifier *ident,
+			      double bigram_weight = 0.0,
+			      bool apply_stop_grams = false) ;
+      ~SlidingWindowIdentifier() ;
+
+      void reset() ;
+      // score buffer[0..buflen), whose first byte is at 'offset' in the
+      //   stream; offsets must not decrease between calls unless reset()
+      //   is called (a backwards move is handled by resetting)
+      LanguageScores *identify(LanguageScores *scores, /* may be NULL */
+			       const char *buffer, size_t buflen,
+			       uint64_t offset) ;
+   } ;
+
 /************************************************************************/
 /*	Procedural interface						*/
 /************************************************************************/
@@ -463,6 +586,10 @@ LanguageIdentifier *load_language_database(const char *database_file,
 					   bool verbose = false) ;
    // set charset_file to NULL for default search, "" to not use a separate
    //    database (use the main database for charset ID as well as lang ID)
+   // database_file may list overlay databases after the main database,
+   //    separated by commas; an empty main database name uses the default
+bool load_language_overlay(LanguageIdentifier *id, const char *overlay_file,
+			   bool verbose = false) ;
 void unload_language_database(LanguageIdentifier *id) ;
 double set_stopgram_penalty(double wt) ;
 
@@ -0,0 +1,113 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*	LangIdent: n-gram based language-identification			*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File: modelsim.h - approximate all-pairs model similarities		*/
+/*  Version:  1.25				       			*/
+/*  LastEdit: 19oct2026							*/
+/*									*/
+/*  (c) Copyright 2026 Ralf Brown/CMU					*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __MODELSIM_H_INCLUDED
+#define __MODELSIM_H_INCLUDED
+
+#include <cstdio>
+#include <stdint.h>
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// the sketch of each model is this many 64-bit words of SimHash bits
+#define SIMHASH_WORDS 4
+#define SIMHASH_BITS (64 * SIMHASH_WORDS)
+
+/************************************************************************/
+/************************************************************************/
+
+class PackedMultiTrie ;
+
+//----------------------------------------------------------------------
+
+class ModelSimilarity
+   {
+   public:
+      uint32_t	m_model1 ;
+      uint32_t	m_model2 ;
+      double	m_similarity ;
+   public:
+      // accessors
+      uint32_t model1() const { return m_model1 ; }
+      uint32_t model2() const { return m_model2 ; }
+      double similarity() const { return m_similarity ; }
+
+      // sorting by model numbers
+      static int compare(const ModelSimilarity *s1, const ModelSimilarity *s2) ;
+      static void swap(ModelSimilarity &s1, ModelSimilarity &s2) ;
+   } ;
+
+//----------------------------------------------------------------------
+// cosine similarities between the models in a packed trie, for all
+//   pairs of models which are at least as similar as a given threshold.
+//   Instead of comparing the full n-gram profiles of every pair of
+//   models, each model's profile is reduced to a SimHash sketch (the
+//   signs of SIMHASH_BITS random projections of its n-gram probability
+//   vector, whose Hamming distance estimates the angle between two
+//   models); bands of sketch bits are then used as locality-sensitive
+//   hashes to find the candidate pairs, and the exact cosine is computed
+//   only for the candidates which the sketches estimate to be close to
+//   the threshold or above it.  A pair above the threshold will
+//   occasionally be missed, but not reported wrongly.
+
+class ModelSimilarities
+   {
+   private:
+      uint64_t	      *m_sketches ;	// SIMHASH_WORDS per model
+      ModelSimilarity *m_pairs ;	// both orders, sorted by model1
+      size_t	      *m_first ;	// first pair for each model
+      size_t	       m_numpairs ;
+      size_t	       m_candidates ;
+      size_t	       m_nummodels ;
+      double	       m_threshold ;
+   protected:
+      bool computeSketches(const PackedMultiTrie *trie, unsigned threads) ;
+      uint64_t *findCandidates(size_t &count) const ;
+      bool computeExact(const PackedMultiTrie *trie, uint64_t *candidates) ;
+   public:
+      ModelSimilarities(const PackedMultiTrie *trie, size_t num_models,
+			double threshold, unsigned threads = 1) ;
+      ~ModelSimilarities() ;
+
+      // accessors
+      bool good() const { return m_first != 0 ; }
+      double threshold() const { return m_threshold ; }
+      size_t numModels() const { return m_nummodels ; }
+      size_t numPairs() const { return m_numpairs ; }
+      size_t numCandidates() const { return m_candidates ; }
+      // the models similar to the given one, as a range of pairs whose
+      //   model1() is that model
+      const ModelSimilarity *similarModels(size_t model, size_t &count) const ;
+      // the exact similarity if at least the threshold, else zero
+      double similarity(size_t model1, size_t model2) const ;
+      // the similarity estimated from the two models' sketches
+      double estimatedSimilarity(size_t model1, size_t model2) const ;
+   } ;
+
+#endif /* !__MODELSIM_H_INCLUDED */
+
+/* end of file modelsim.h */
@@ -4,8 +4,8 @@
 /*	by Ralf Brown / Carnegie Mellon University			*/
 /*									*/
 /*  File: mtrie.h - bit-slice-based Word-frequency multi-trie		*/
-/*  Version:  1.19				       			*/
-/*  LastEdit: 08oct2012							*/
+/*  Version:  1.25				       			*/
+/*  LastEdit: 19oct2026							*/
 /*									*/
 /*  (c) Copyright 2011,2012 Ralf Brown/CMU				*/
 /*      This program is free software; you can redistribute it and/or   */
@@ -183,7 +183,10 @@ class MultiTrie
    public:
       MultiTrie(uint32_t capacity = 0) ;
       MultiTrie(const char *filename, bool verbose) ;
-      MultiTrie(const class PackedMultiTrie *) ;
+      // langmap, if given, renumbers the packed trie's language IDs;
+      //   entries of (uint32_t)~0 drop that language's n-grams
+      MultiTrie(const class PackedMultiTrie *,
+		const uint32_t *langmap = 0) ;
       ~MultiTrie() ;
 
       bool loadWords(const char *filename, uint32_t langID,
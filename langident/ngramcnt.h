@@ -0,0 +1,139 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*	LangIdent: n-gram based language-identification			*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File: ngramcnt.h - hashed n-gram counts for model training		*/
+/*  Version:  1.25				       			*/
+/*  LastEdit: 19oct2026							*/
+/*									*/
+/*  (c) Copyright 2026 Ralf Brown/CMU					*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __NGRAMCNT_H_INCLUDED
+#define __NGRAMCNT_H_INCLUDED
+
+#include <cstdio>
+#include <stdint.h>
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+#define NGRAMCOUNTS_DEFAULT_CAPACITY 65536
+
+/************************************************************************/
+/************************************************************************/
+
+class NybbleTrie ;
+
+//----------------------------------------------------------------------
+
+class NgramCount
+   {
+   public:
+      size_t	m_key ;			// offset in the counter's key buffer
+      uint32_t	m_hash ;
+      uint32_t	m_count ;
+      uint32_t	m_maxchild ;		// highest count of a one-byte extension
+      uint32_t	m_keylen ;		// zero for an unused slot
+      static const uint8_t *s_keys ;	// makes compare() non-reentrant
+   public:
+      // accessors
+      unsigned keyLength() const { return m_keylen ; }
+      uint32_t count() const { return m_count ; }
+      uint32_t maxChildCount() const { return m_maxchild ; }
+
+      // modifiers
+      void setCount(uint32_t count) { m_count = count ; }
+
+      // sorting: keys in the order NybbleTrie::enumerate() visits them
+      static int compare(const NgramCount *n1, const NgramCount *n2) ;
+      static void swap(NgramCount &n1, NgramCount &n2) ;
+   } ;
+
+//----------------------------------------------------------------------
+
+typedef bool NgramCountEnumFn(const uint8_t *key, unsigned keylen,
+			      uint32_t count, void *user_data) ;
+
+//----------------------------------------------------------------------
+// open-addressing hash table of n-gram counts, used instead of a
+//   NybbleTrie while counting the n-grams of the training data: each
+//   increment is a single probe instead of four dependent node hops per
+//   key byte, and each n-gram takes a fixed-size slot plus its key bytes
+//   instead of a chain of trie nodes.  Once counting is complete, the
+//   counts are sorted into trie order for filtering.
+
+class NgramCounts
+   {
+   private:
+      NgramCount *m_table ;
+      size_t	  m_capacity ;		// always a power of two
+      size_t	  m_used ;
+      uint8_t	 *m_keys ;
+      size_t	  m_keybytes ;
+      size_t	  m_allockeys ;
+      unsigned	  m_maxkeylen ;
+      bool	  m_sorted ;
+      bool	  m_good ;
+   protected:
+      NgramCount *slot(const uint8_t *key, unsigned keylen,
+		       uint32_t hash) const ;
+      bool grow() ;
+      bool storeKey(const uint8_t *key, unsigned keylen, size_t &offset) ;
+      NgramCount *add(const uint8_t *key, unsigned keylen, uint32_t hash,
+		      uint32_t incr, size_t &keyoffset) ;
+      void computeMaxChildren() ;
+   public:
+      NgramCounts(size_t capacity = NGRAMCOUNTS_DEFAULT_CAPACITY) ;
+      ~NgramCounts() ;
+
+      // accessors
+      bool good() const { return m_good ; }
+      bool sorted() const { return m_sorted ; }
+      size_t size() const { return m_used ; }
+      unsigned longestKey() const { return m_maxkeylen ; }
+      const uint8_t *key(const NgramCount *n) const
+	 { return m_keys + n->m_key ; }
+      NgramCount *find(const uint8_t *key, unsigned keylen) const ;
+      // compare the n-gram's key against another key, in sorted order
+      int compare(const NgramCount *n, const uint8_t *key,
+		  unsigned keylen) const ;
+      // only valid after sort(), with N < size()
+      NgramCount *sortedCount(size_t N) const { return &m_table[N] ; }
+      bool enumerate(NgramCountEnumFn *fn, void *user_data) const ;
+
+      // modifiers
+      uint32_t increment(const uint8_t *key, unsigned keylen,
+			 uint32_t incr = 1) ;
+      // like NybbleTrie::incrementExtensions(), with the prefix of
+      //   'prevlength' bytes looked up in 'prefixes'
+      bool incrementExtensions(const NybbleTrie *prefixes,
+			       const uint8_t *key, unsigned prevlength,
+			       unsigned keylength, uint32_t incr = 1) ;
+      // put the counts in key order and determine each n-gram's highest
+      //   extension count; afterwards, no further counts can be added
+      //   or looked up
+      bool sort() ;
+      // add the counts to the given trie, as if it had been incremented
+      //   directly
+      bool addTo(NybbleTrie *trie) const ;
+   } ;
+
+#endif /* !__NGRAMCNT_H_INCLUDED */
+
+/* end of file ngramcnt.h */
@@ -4,8 +4,8 @@
 /*	by Ralf Brown / Carnegie Mellon University			*/
 /*									*/
 /*  File: ptrie.h - packed Word-frequency multi-trie			*/
-/*  Version:  1.21				       			*/
-/*  LastEdit: 03jan2013							*/
+/*  Version:  1.25				       			*/
+/*  LastEdit: 18oct2026							*/
 /*									*/
 /*  (c) Copyright 2011,2012,2013 Ralf Brown/CMU				*/
 /*      This program is free software; you can redistribute it and/or   */
@@ -307,6 +307,9 @@ class PackedMultiTrie
       // I/O
       static PackedMultiTrie *load(FILE *fp, const char *filename) ;
       static PackedMultiTrie *load(const char *filename) ;
+      static bool writeHeader(FILE *fp, uint32_t numnodes, unsigned longestkey,
+			      uint32_t numfreq, uint32_t numterminals,
+			      bool ignore_whitespace, PTrieCase cs) ;
       bool write(FILE *fp) const ;
       bool write(const char *filename) const ;
       bool dump(FILE *fp) const ;
@@ -0,0 +1,111 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*	LangIdent: n-gram based language-identification			*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File: ptriebld.h - external-memory packed multi-trie construction	*/
+/*  Version:  1.25				       			*/
+/*  LastEdit: 19oct2026							*/
+/*									*/
+/*  (c) Copyright 2026 Ralf Brown/CMU					*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __PTRIEBLD_H_INCLUDED
+#define __PTRIEBLD_H_INCLUDED
+
+#include <cstdio>
+#include <stdint.h>
+#include "FramepaC.h"
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// how many bytes of n-grams to collect in memory before sorting them and
+//   writing them out as a run
+#define PTRIEBLD_DEFAULT_RUN_MEMORY (64 * 1024 * 1024)
+
+// how many runs to merge at once; more runs than this require
+//   intermediate merges
+#define PTRIEBLD_DEFAULT_FANIN 64
+
+/************************************************************************/
+/************************************************************************/
+
+class PackedMultiTrie ;
+class TrieRunFreq ;
+class TrieRunNgram ;
+
+typedef bool TrieRunFn(const uint8_t *key, unsigned keylen,
+		       const TrieRunFreq *freqs, unsigned numfreqs,
+		       void *user_data) ;
+
+//----------------------------------------------------------------------
+// build the packed multi-trie for a language database without ever
+//   holding the full vocabulary in memory: n-grams are collected into
+//   sorted runs on disk, and the runs are k-way merged while writing the
+//   trie's nodes, frequency records, and terminals straight into the
+//   database file.  The result is byte-for-byte what PackedMultiTrie
+//   would produce from a MultiTrie holding the same n-grams.
+
+class PackedTrieBuilder
+   {
+   private:
+      char	   *m_tempdir ;
+      char	  **m_runs ;		// names of the sorted run files
+      size_t	    m_numruns ;
+      size_t	    m_allocruns ;
+      TrieRunNgram *m_ngrams ;		// n-grams for the next run
+      size_t	    m_numngrams ;
+      size_t	    m_allocngrams ;
+      uint8_t	   *m_keys ;		// key strings for m_ngrams
+      size_t	    m_keybytes ;
+      size_t	    m_allockeys ;
+      uint32_t	   *m_dropped ;		// langID -> runs to ignore it in
+      size_t	    m_run_memory ;
+      unsigned	    m_fanin ;
+      bool	    m_sorted ;		// m_ngrams already in run order?
+      bool	    m_good ;
+   protected:
+      char *newRunFile(FILE *&fp) ;
+      bool flushRun() ;
+      bool mergeRuns(size_t first, size_t count, TrieRunFn *fn,
+		     void *user_data) const ;
+      bool reduceRuns() ;
+   public:
+      PackedTrieBuilder(const char *tempdir = 0,
+			size_t run_memory = PTRIEBLD_DEFAULT_RUN_MEMORY,
+			unsigned fanin = PTRIEBLD_DEFAULT_FANIN) ;
+      ~PackedTrieBuilder() ;
+
+      // accessors
+      bool good() const { return m_good ; }
+      size_t numRuns() const { return m_numruns ; }
+
+      // modifiers
+      bool insert(const uint8_t *key, unsigned keylength, uint32_t langID,
+		  uint32_t frequency, bool stopgram) ;
+      bool insert(const PackedMultiTrie *trie) ;
+      // discard the n-grams inserted so far for the given language
+      bool dropLanguage(uint32_t langID) ;
+
+      // I/O
+      bool write(FILE *fp) ;
+   } ;
+
+#endif /* !__PTRIEBLD_H_INCLUDED */
+
+/* end of file ptriebld.h */
@@ -0,0 +1,109 @@
+/****************************** -*- C++ -*- *****************************/
+/*                                                                      */
+/*	LA-Strings: language-aware text-strings extraction		*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File:     outbuf.h							*/
+/*  Version:  1.25							*/
+/*  LastEdit: 18oct2026							*/
+/*                                                                      */
+/*  (c) Copyright 2026 Ralf Brown/Carnegie Mellon University		*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __OUTBUF_H_INCLUDED
+#define __OUTBUF_H_INCLUDED
+
+#include <cstdio>
+#include <stdint.h>
+#include "language.h" // for OutputFormat
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// the size of the output buffer; it is written out once a record leaves
+//   it at least half full
+#define OUTPUT_BUFFER_SIZE 65536
+
+/************************************************************************/
+/************************************************************************/
+
+// collects the formatted output for extracted strings and writes it to
+//   the output file in large blocks.  The text() and number() functions
+//   produce the program's own text (labels, offsets, scores), converting
+//   it to UTF-16 if that is the output format; put() and write() copy
+//   bytes which are already in the output format.  An OutputBuffer
+//   created without a file collects everything in memory instead, growing
+//   as needed, until the caller retrieves it with data() and length().
+class OutputBuffer
+   {
+   private:
+      FILE	  *m_fp ;
+      char	  *m_buffer ;
+      size_t	   m_len ;
+      size_t	   m_alloc ;
+      OutputFormat m_format ;
+      bool	   m_interactive ;	// flush after every record?
+      bool	   m_memory ;		// collecting output in memory?
+      bool	   m_error ;
+   protected:
+      void overflow(size_t needed) ;
+      void UTF16(uint32_t codepoint, bool big_endian) ;
+      void textChar(unsigned char c)
+	 { if (m_format == OF_UTF16LE || m_format == OF_UTF16BE)
+	      UTF16(c,m_format == OF_UTF16BE) ;
+	   else
+	      put(c) ; }
+   public:
+      OutputBuffer(FILE *fp, OutputFormat fmt = OF_Native) ;
+      OutputBuffer(OutputFormat fmt = OF_Native) ;	// in-memory buffer
+      ~OutputBuffer() ;
+
+      // accessors
+      FILE *file() const { return m_fp ; }
+      bool good() const { return !m_error ; }
+      const char *data() const { return m_buffer ; }
+      size_t length() const { return m_len ; }
+
+      // raw bytes
+      void put(char c)
+	 { if (m_len >= m_alloc) overflow(1) ;
+	   if (m_len < m_alloc) m_buffer[m_len++] = c ;
+	   else if (m_fp && fputc(c,m_fp) == EOF) m_error = true ; }
+      void write(const void *data, size_t len) ;
+
+      // text, converted as needed for the output format
+      void text(char c) { textChar((unsigned char)c) ; }
+      void text(const char *s) ;
+      void text(const char *s, size_t maxlen) ;
+      // an unsigned integer, zero-padded to at least 'width' digits
+      void number(uint64_t value, unsigned radix, unsigned width) ;
+      // a number formatted as by printf's "%W.Df" and "%g"
+      void fixed(double value, unsigned width, unsigned decimals) ;
+      void general(double value) ;
+
+      // call after each complete record
+      void endRecord()
+	 { if (m_interactive || (!m_memory && m_len >= OUTPUT_BUFFER_SIZE / 2))
+	      flush() ; }
+      bool flush() ;
+      // discard the contents of an in-memory buffer
+      void clear() { m_len = 0 ; }
+   } ;
+
+#endif /* !__OUTBUF_H_INCLUDED */
+
+/* end of file outbuf.h */
@@ -0,0 +1,101 @@
+/****************************** -*- C++ -*- *****************************/
+/*                                                                      */
+/*	LA-Strings: language-aware text-strings extraction		*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File:     prefilter.h						*/
+/*  Version:  1.25							*/
+/*  LastEdit: 18oct2026							*/
+/*                                                                      */
+/*  (c) Copyright 2026 Ralf Brown/Carnegie Mellon University		*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __PREFILTER_H_INCLUDED
+#define __PREFILTER_H_INCLUDED
+
+#include <cstddef>
+#include <stdint.h>
+
+/************************************************************************/
+/************************************************************************/
+
+class CharacterSet ;
+
+// locate the places in a buffer where a string could possibly start in
+//   any of a set of candidate character sets, so that the extraction loop
+//   can jump over binary data instead of trying every byte offset
+class RunPrefilter
+   {
+   private:
+      unsigned char m_roles[256] ;	// union of the sets' byte roles
+      unsigned char m_lead_min ;	// lowest and highest bytes which
+      unsigned char m_lead_max ;	//   can start a character
+      bool	    m_useful ;		// can any bytes be skipped at all?
+   public:
+      RunPrefilter() { m_useful = false ; }
+      ~RunPrefilter() {}
+
+      void setCharSets(const CharacterSet * const *charsets) ;
+
+      // accessors
+      bool useful() const { return m_useful ; }
+      // number of bytes from the start of 'buf' (at most 'len') at which
+      //   no character can start in any of the character sets
+      size_t deadBytes(const unsigned char *buf, size_t len) const ;
+      // number of bytes from the start of 'buf' (at most 'len') which
+      //   could all be part of the same string
+      size_t liveBytes(const unsigned char *buf, size_t len) const ;
+   } ;
+
+//----------------------------------------------------------------------
+
+// recognize blocks of compressed or encrypted data at the start of the
+//   input buffer, which never contain genuine strings; also keeps the
+//   statistics on how much input was skipped as irrelevant
+class EntropyFilter
+   {
+   private:
+      double	m_threshold ;		// bits per byte; 0 = never skip
+      uint64_t	m_checked ;		// input before here is known normal
+      uint64_t	m_fill_bytes ;		// bytes of repeated fill skipped
+      uint64_t	m_entropy_bytes ;	// bytes of high-entropy data skipped
+      uint64_t	m_hole_bytes ;		// bytes of sparse-file holes skipped
+   public:
+      EntropyFilter(double threshold)
+	 { m_threshold = threshold ; m_checked = 0 ;
+	   m_fill_bytes = m_entropy_bytes = m_hole_bytes = 0 ; }
+      ~EntropyFilter() {}
+
+      // number of bytes at the start of 'buf' (located at 'bufloc' in
+      //   the input) which belong to a high-entropy block and may be
+      //   skipped
+      unsigned skippable(const unsigned char *buf, unsigned buflen,
+			 uint64_t bufloc) ;
+      void addFillBytes(unsigned count) { m_fill_bytes += count ; }
+      void addHoleBytes(uint64_t count) { m_hole_bytes += count ; }
+
+      // accessors
+      uint64_t fillBytes() const { return m_fill_bytes ; }
+      uint64_t entropyBytes() const { return m_entropy_bytes ; }
+      uint64_t holeBytes() const { return m_hole_bytes ; }
+   } ;
+
+// Shannon entropy in bits per byte of the given bytes
+double block_entropy(const unsigned char *buf, size_t len) ;
+
+#endif /* !__PREFILTER_H_INCLUDED */
+
+/* end of file prefilter.h */
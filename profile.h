@@ -0,0 +1,107 @@
+/****************************** -*- C++ -*- *****************************/
+/*                                                                      */
+/*	LA-Strings: language-aware text-strings extraction		*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File:     profile.h							*/
+/*  Version:  1.25							*/
+/*  LastEdit: 18oct2026							*/
+/*                                                                      */
+/*  (c) Copyright 2026 Ralf Brown/Carnegie Mellon University		*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __PROFILE_H_INCLUDED
+#define __PROFILE_H_INCLUDED
+
+#include <cstdio>
+#include <stdint.h>
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// the processing stages for which we accumulate time and byte counts
+enum ProfileStage
+   {
+      PS_Read,			// filling the input buffer
+      PS_Skip,			// recognizing compressed/encrypted data
+      PS_CharsetID,		// automatic character-set identification
+      PS_Extract,		// extracting candidate strings
+      PS_LangID,		// language identification of strings
+      PS_Smoothing,		// smoothing of language scores
+      PS_Output,		// formatting and writing the strings
+      PS_NumStages
+   } ;
+
+/************************************************************************/
+/************************************************************************/
+
+#ifdef NO_STAGE_TIMING
+
+class StageTimer
+   {
+   public:
+      StageTimer(ProfileStage) {}
+      void addBytes(uint64_t) {}
+   } ;
+
+inline void profile_stages(bool, bool = false) {}
+inline bool profiling_stages() { return false ; }
+inline void profile_start_file(const char *) {}
+inline void profile_end_file(FILE *) {}
+inline void profile_report(FILE *) {}
+
+#else
+
+extern bool stage_timing_enabled ;
+
+// accumulate the time between construction and destruction into the given
+//   stage; time spent in a nested StageTimer is charged to the inner stage
+//   and excluded from the outer stage's self time
+class StageTimer
+   {
+   private:
+      StageTimer   *m_parent ;
+      uint64_t	    m_start ;
+      uint64_t	    m_resumed ;
+      uint64_t	    m_bytes ;
+      ProfileStage  m_stage ;
+      bool	    m_active ;
+   protected:
+      void start() ;
+      void stop() ;
+   public:
+      StageTimer(ProfileStage stage)
+	 { m_active = stage_timing_enabled ; m_bytes = 0 ;
+	   if (m_active) { m_stage = stage ; start() ; } }
+      ~StageTimer() { if (m_active) stop() ; }
+
+      void addBytes(uint64_t bytes) { m_bytes += bytes ; }
+      void pause(uint64_t now) ;
+      void resume(uint64_t now) { m_resumed = now ; }
+   } ;
+
+void profile_stages(bool enable, bool per_file = false) ;
+inline bool profiling_stages() { return stage_timing_enabled ; }
+void profile_start_file(const char *filename) ;
+void profile_end_file(FILE *fp) ;
+void profile_report(FILE *fp) ;
+
+#endif /* NO_STAGE_TIMING */
+
+#endif /* !__PROFILE_H_INCLUDED */
+
+/* end of file profile.h */
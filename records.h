@@ -0,0 +1,96 @@
+/****************************** -*- C++ -*- *****************************/
+/*                                                                      */
+/*	LA-Strings: language-aware text-strings extraction		*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File:     records.h						*/
+/*  Version:  1.25							*/
+/*  LastEdit: 18oct2026							*/
+/*                                                                      */
+/*  (c) Copyright 2026 Ralf Brown/Carnegie Mellon University		*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __RECORDS_H_INCLUDED
+#define __RECORDS_H_INCLUDED
+
+#include <stdint.h>
+#include "extract.h"
+#include "outbuf.h"
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// the binary record format: each input file's output starts with a
+//   header block beginning with this eight-byte signature, and the
+//   header and every record are padded to a multiple of eight bytes
+#define RECORD_SIGNATURE "LASTRBIN"
+#define RECORD_FORMAT_VERSION 1
+#define RECORD_ALIGN 8
+
+// size of the fixed part of a binary record, which precedes the
+//   (language ID, score) pairs and the UTF-8 text
+#define RECORD_FIXED_SIZE 28
+
+// the most language guesses stored in a record
+#define MAX_RECORD_LANGUAGES 255
+
+// encoding ID for a string whose character set is not in the header's
+//   encoding table
+#define RECORD_UNKNOWN_ENCODING 0xFFFF
+
+/************************************************************************/
+/************************************************************************/
+
+// writes extracted strings as self-describing records (JSON Lines or
+//   the binary format) instead of the tab-separated text output.  The
+//   header lists the encodings and language models; records refer to
+//   them by their position in those tables.
+class StringRecordWriter
+   {
+   private:
+      OutputBuffer	   &m_out ;
+      OutputBuffer	    m_text ;		// UTF-8 version of the string
+      OutputBuffer	    m_clean ;		// ...with invalid bytes replaced
+      const ExtractParameters *m_params ;
+      const CharacterSet **m_encodings ;
+      const CharacterSet  *m_last_charset ;	// most recent lookup
+      unsigned		    m_num_encodings ;
+      unsigned		    m_last_encoding ;
+      bool		    m_binary ;
+   protected:
+      void addEncoding(const CharacterSet *charset) ;
+      unsigned encodingID(const CharacterSet *charset) ;
+      const OutputBuffer &convertText(const unsigned char *buffer,
+				      unsigned len, CharacterSet *charset) ;
+      void writeJSONHeader(const char *filename) ;
+      void writeBinaryHeader(const char *filename) ;
+   public:
+      StringRecordWriter(OutputBuffer &out, const ExtractParameters *params,
+			 const CharacterSet * const *charsets) ;
+      ~StringRecordWriter() ;
+
+      void writeHeader(const char *filename) ;
+      // 'langs' and 'scores' hold the top 'numlangs' language guesses
+      void writeRecord(const unsigned char *buffer, unsigned len,
+		       uint64_t bufloc, double confidence,
+		       CharacterSet *charset, const unsigned *langs,
+		       const double *scores, unsigned numlangs) ;
+   } ;
+
+#endif /* !__RECORDS_H_INCLUDED */
+
+/* end of file records.h */
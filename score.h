@@ -4,8 +4,8 @@
 /*	by Ralf Brown / Carnegie Mellon University			*/
 /*									*/
 /*  File:     score.h							*/
-/*  Version:  1.09							*/
-/*  LastEdit: 02dec2011							*/
+/*  Version:  1.25							*/
+/*  LastEdit: 18oct2026							*/
 /*                                                                      */
 /*  (c) Copyright 2010,2011 Ralf Brown/Carnegie Mellon University	*/
 /*      This program is free software; you can redistribute it and/or   */
@@ -44,9 +44,45 @@ class StringScore
       StringScore() ;
       ~StringScore() {}
 
+      void clear() ;
       void haveDictionary() { m_have_dictionary = true ; }
       void update(const class CharacterSet *, wchar_t codepoint,
 		  int charsize = 1) ;
+      void update(bool is_alpha, bool is_desired, bool is_blank,
+		  unsigned charsize = 1)
+	 {
+	 m_total_chars += charsize ;
+	 if (is_alpha)
+	    m_total_alpha += charsize ;
+	 if (is_alpha || is_blank)
+	    m_alpha_run += charsize ;
+	 else
+	    endAlphaRun() ;
+	 if (is_desired)
+	    m_total_desired += charsize ;
+	 if (is_desired || is_blank)
+	    {
+	    m_desired_run += charsize ;
+	    m_other_run = 0 ;
+	    }
+	 else
+	    {
+	    endDesiredRun() ;
+	    m_other_run += charsize ;
+	    }
+	 }
+      // equivalent to 'count' updates by alphanumeric desired characters
+      void updateRun(unsigned count)
+	 {
+	 m_total_chars += count ;
+	 m_total_alpha += count ;
+	 m_alpha_run += count ;
+	 m_total_desired += count ;
+	 m_desired_run += count ;
+	 m_other_run = 0 ;
+	 }
+      void endAlphaRun() ;
+      void endDesiredRun() ;
       void addWord(int wordlength) ;
       void setLanguageScore(const class LanguageScores *scores) ;
       void finalize() ;
@@ -0,0 +1,64 @@
+/****************************** -*- C++ -*- *****************************/
+/*                                                                      */
+/*	LA-Strings: language-aware text-strings extraction		*/
+/*	by Ralf Brown / Carnegie Mellon University			*/
+/*									*/
+/*  File:     sniffer.h							*/
+/*  Version:  1.25							*/
+/*  LastEdit: 18oct2026							*/
+/*                                                                      */
+/*  (c) Copyright 2026 Ralf Brown/Carnegie Mellon University		*/
+/*      This program is free software; you can redistribute it and/or   */
+/*      modify it under the terms of the GNU General Public License as  */
+/*      published by the Free Software Foundation, version 3.           */
+/*                                                                      */
+/*      This program is distributed in the hope that it will be         */
+/*      useful, but WITHOUT ANY WARRANTY; without even the implied      */
+/*      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR         */
+/*      PURPOSE.  See the GNU General Public License for more details.  */
+/*                                                                      */
+/*      You should have received a copy of the GNU General Public       */
+/*      License (file COPYING) along with this program.  If not, see    */
+/*      http://www.gnu.org/licenses/                                    */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef __SNIFFER_H_INCLUDED
+#define __SNIFFER_H_INCLUDED
+
+#include <cstddef>
+
+/************************************************************************/
+/************************************************************************/
+
+// Quick tests for the wide and variable-length encodings which automatic
+//   character-set identification adds to the candidates regardless of what
+//   the charset models say.  Each sniffer accumulates a weighted count of
+//   the valid characters in the buffer, where a character following
+//   another valid one counts for more; the buffer_contains_XXX() functions
+//   apply the acceptance thresholds to those counts.  Only UTF-8 and
+//   little-endian ASCII-16 are sniffed during identification: the
+//   big-endian form also matches little-endian text at an odd offset, and
+//   the 32-bit forms match tables of small integers in binary files.
+
+// weighted count of valid UTF-8 characters; 'multibyte' is set to the
+//   number of multi-byte sequences among them
+size_t sniff_UTF8(const unsigned char *buffer, size_t buflen,
+		  size_t &multibyte) ;
+
+// weighted count of ASCII or Latin-1 characters encoded as 16-bit
+//   (UCS-2/UTF-16) or 32-bit (UTF-32) code units
+size_t sniff_ASCII16(const unsigned char *buffer, size_t buflen,
+		     bool bigendian) ;
+size_t sniff_ASCII32(const unsigned char *buffer, size_t buflen,
+		     bool bigendian) ;
+
+bool buffer_contains_UTF8(const unsigned char *buffer, size_t buflen) ;
+bool buffer_contains_ASCII16(const unsigned char *buffer, size_t buflen,
+			     bool bigendian = false) ;
+bool buffer_contains_ASCII32(const unsigned char *buffer, size_t buflen,
+			     bool bigendian = false) ;
+
+#endif /* !__SNIFFER_H_INCLUDED */
+
+/* end of file sniffer.h */
@@ -0,0 +1,222 @@
+#!/bin/sh
+#
+# bench.sh -- reproducible throughput benchmark for la-strings, whatlang,
+#	and mklangid; results are written as JSON for tracking across
+#	releases.  Normally run via 'make bench' from the top directory.
+#
+# Written in plain sh rather than csh because it needs shell functions.
+
+usage() {
+   echo "Usage: $0 [options]"
+   echo "Options:"
+   echo "  -o FILE   write JSON results to FILE (default bench.json)"
+   echo "  -d DIR    build the synthetic inputs in DIR (default bench.tmp)"
+   echo "  -n N      time each command N times (default 3)"
+   echo "  -s MB     size of the synthetic binary input (default 8)"
+   echo "  -l DB     language database for -i modes (default: build one)"
+   echo "  -c DB     character-set database for the auto-encoding mode"
+   exit 1
+}
+
+output=bench.json
+workdir=bench.tmp
+repeats=3
+size_mb=8
+langdb=""
+charsetdb=""
+while [ $# -gt 0 ]; do
+   case "$1" in
+      -o) output="$2" ; shift 2 ;;
+      -d) workdir="$2" ; shift 2 ;;
+      -n) repeats="$2" ; shift 2 ;;
+      -s) size_mb="$2" ; shift 2 ;;
+      -l) langdb="$2" ; shift 2 ;;
+      -c) charsetdb="$2" ; shift 2 ;;
+      *) usage ;;
+   esac
+done
+
+LC_ALL=C
+export LC_ALL
+top=$(pwd)
+lastrings=$top/la-strings
+mklangid=$top/langident/mklangid
+whatlang=$top/langident/whatlang
+for prog in $lastrings $mklangid $whatlang ; do
+   if [ ! -x $prog ]; then
+      echo "$prog has not been built" 1>&2
+      exit 1
+   fi
+done
+mkdir -p $workdir || exit 1
+
+# the models used for the timed database build, and for the -i modes
+#   unless a database was given with -l
+models=""
+for lang in en de fr es it nl pt ru ar ja NUM ; do
+   models="$models $(ls models/$lang.*.lid 2>/dev/null)"
+done
+
+now_ns() {
+   date +%s%N
+}
+
+filesize() {
+   wc -c <"$1" | tr -d ' '
+}
+
+checksum() {
+   if command -v md5sum >/dev/null 2>&1 ; then
+      md5sum <"$1" | cut -d' ' -f1
+   else
+      cksum <"$1" | cut -d' ' -f1
+   fi
+}
+
+json_string() {
+   printf '"%s"' "$(printf '%s' "$1" | sed -e 's/[\\"]/\\&/g')"
+}
+
+#########################################################################
+## synthetic inputs
+
+# pseudo-random filler from a fixed-seed Park-Miller generator, so that
+#   every run (and every machine) sees exactly the same bytes
+echo "Generating synthetic inputs in $workdir"
+awk -v n=1048576 'BEGIN {
+   x = 20140819
+   for (i = 0 ; i < n ; i++)
+      {
+      x = (x * 16807) % 2147483647
+      b = int(x / 128) % 255 + 1
+      printf "%c", b
+      }
+   }' >$workdir/filler.bin
+fillsize=$(filesize $workdir/filler.bin)
+
+# interleave the test corpora with filler: random bytes, runs of NULs,
+#   and little-endian integer tables resembling binary file contents
+target=$(expr $size_mb \* 1048576)
+: >$workdir/mixed.bin
+: >$workdir/text.txt
+textfiles=$(ls test/*.txt | sort)
+for f in $textfiles ; do
+   case $f in
+      *.utf8.txt) cat $f >>$workdir/text.txt ;;
+   esac
+done
+count=0
+offset=1
+while [ $(filesize $workdir/mixed.bin) -lt $target ]; do
+   for f in $textfiles ; do
+      count=$(expr $count + 1)
+      len=$(expr \( $count \* 2654435761 \) % 7681 + 512)
+      if [ $(expr $offset + $len) -ge $fillsize ]; then
+	 offset=1
+      fi
+      cat $f
+      case $(expr $count % 5) in
+	 0) head -c $len /dev/zero ;;
+	 1) awk -v n=$(expr $len / 4) -v s=$count 'BEGIN {
+	       for (i = 0 ; i < n ; i++)
+		  printf "%c%c%c%c", (s+i)%256, int((s+i)/256)%256, 0, 0
+	       }' ;;
+	 *) tail -c +$offset $workdir/filler.bin | head -c $len ;;
+      esac
+      offset=$(expr $offset + $len)
+   done >>$workdir/mixed.bin
+done
+head -c $target $workdir/mixed.bin >$workdir/input.bin
+rm -f $workdir/mixed.bin
+input=$workdir/input.bin
+inputsize=$(filesize $input)
+textsize=$(filesize $workdir/text.txt)
+modelsize=$(cat $models | wc -c | tr -d ' ')
+
+#########################################################################
+## timing
+
+results=""
+
+# usage: time_command NAME BYTES RUNS command args...
+time_command() {
+   name=$1 ; bytes=$2 ; runs=$3
+   shift 3
+   echo "  $name"
+   times=""
+   i=0
+   while [ $i -lt $runs ]; do
+      start=$(now_ns)
+      "$@" >$workdir/out.$name 2>/dev/null
+      status=$?
+      end=$(now_ns)
+      times="$times $(expr $end - $start)"
+      i=$(expr $i + 1)
+   done
+   outbytes=$(filesize $workdir/out.$name)
+   outsum=$(checksum $workdir/out.$name)
+   rm -f $workdir/out.$name
+   entry=$(echo $times | tr ' ' '\n' | sort -n | awk -v bytes=$bytes '
+      { t[NR] = $1 / 1e9 }
+      END {
+	 med = (NR % 2) ? t[(NR+1)/2] : (t[NR/2] + t[NR/2+1]) / 2
+	 rate = (t[1] > 0) ? bytes / 1048576 / t[1] : 0
+	 printf "\"runs_s\": ["
+	 for (i = 1 ; i <= NR ; i++)
+	    printf "%s%.4f", (i > 1 ? ", " : ""), t[i]
+	 printf "], \"best_s\": %.4f, \"median_s\": %.4f, \"mb_per_s\": %.3f", t[1], med, rate
+      }')
+   command=$(echo "$*" | sed -e "s|$top/||g")
+   results="$results${results:+,
+}    { \"name\": $(json_string $name), \"command\": $(json_string "$command"), \"bytes\": $bytes, \"exit_status\": $status, \"output_bytes\": $outbytes, \"output_checksum\": $(json_string $outsum), $entry }"
+}
+
+echo "Timing"
+# mklangid adds to an existing database, so start from scratch every run
+rm -f $workdir/bench.db
+time_command mklangid $modelsize 1 $mklangid =$workdir/bench.db -f $models
+if [ -z "$langdb" ]; then
+   langdb=$workdir/bench.db
+fi
+if [ -n "$charsetdb" ]; then
+   autoenc="-e=$charsetdb"
+else
+   autoenc=""
+fi
+time_command ascii $inputsize $repeats $lastrings -eASCII $input
+time_command auto $inputsize $repeats $lastrings -i$langdb $autoenc -I0 $input
+time_command langid $inputsize $repeats $lastrings -i$langdb $autoenc $input
+time_command utf8 $inputsize $repeats $lastrings -i$langdb $autoenc -u $input
+time_command whatlang $textsize $repeats $whatlang -l$langdb $workdir/text.txt
+time_command whatlang-lines $textsize $repeats $whatlang -b1 -l$langdb $workdir/text.txt
+
+#########################################################################
+## report
+
+version=$(sed -n 's/^#define LASTRINGS_VERSION "\(.*\)"/\1/p' la-strings.h)
+revision=$(git describe --always --dirty 2>/dev/null)
+cpu=$(sed -n 's/^model name[ 	]*: *//p' /proc/cpuinfo 2>/dev/null | head -1)
+{
+   echo "{"
+   echo "  \"benchmark\": \"la-strings\","
+   echo "  \"version\": $(json_string "$version"),"
+   echo "  \"revision\": $(json_string "$revision"),"
+   echo "  \"date\": $(json_string "$(date -u +%Y-%m-%dT%H:%M:%SZ)"),"
+   echo "  \"host\": $(json_string "$(uname -n)"),"
+   echo "  \"system\": $(json_string "$(uname -sr)"),"
+   echo "  \"machine\": $(json_string "$(uname -m)"),"
+   echo "  \"cpu\": $(json_string "$cpu"),"
+   echo "  \"repeats\": $repeats,"
+   echo "  \"inputs\": {"
+   echo "    \"binary\": { \"bytes\": $inputsize, \"checksum\": $(json_string $(checksum $input)) },"
+   echo "    \"text\": { \"bytes\": $textsize, \"checksum\": $(json_string $(checksum $workdir/text.txt)) },"
+   echo "    \"models\": { \"bytes\": $modelsize, \"count\": $(echo $models | wc -w | tr -d ' ') },"
+   echo "    \"language_db\": $(json_string "$langdb")"
+   echo "  },"
+   echo "  \"results\": ["
+   echo "$results"
+   echo "  ]"
+   echo "}"
+} >$output
+echo "Results written to $output"
+exit 0